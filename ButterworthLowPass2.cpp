@@ -8,6 +8,7 @@
 ButterworthLowPass2::ButterworthLowPass2(float fRatio, boolean burnIn){
   _burnIn = burnIn;
   _updated=false;
+  _phase = 0;
   //calc the coeffs for a stand-alone 2nd order filter
   calculateCoefficients(fRatio,0,2);
 }
@@ -15,6 +16,7 @@ ButterworthLowPass2::ButterworthLowPass2(float fRatio, boolean burnIn){
 ButterworthLowPass2::ButterworthLowPass2(float fRatio, int k, int N, boolean burnIn){
   _burnIn = burnIn;
   _updated=false;
+  _phase = 0;
   //calc the coeffs for a component/elementary 2nd order filter
   calculateCoefficients(fRatio,k,N);
 }
@@ -52,6 +54,47 @@ float ButterworthLowPass2::updateF(int newVal){
   return out0;       
 }
 
+int ButterworthLowPass2::decimateF(int in[], int nIn, int factor, float out[]){
+  int nOut = 0;
+  int i = 0;
+  if(nIn>0 && !_updated){
+    //the first reading initialises the history
+    float out0 = updateF(in[0]);
+    i = 1;
+    _phase++;
+    if(_phase>=factor){
+      _phase = 0;
+      out[nOut++] = out0;
+    }
+  }
+  //work on local copies of the history, which are written back at the end of the block
+  int in1 = _in1;
+  int in2 = _in2;
+  float out1 = _out1;
+  float out2 = _out2;
+  int phase = _phase;
+  for(; i<nIn; i++){
+    //apply the gain and the filter, as in updateF()
+    float in0 = float(in[i])*_gain;
+    float out0 = _a0*in0 + _a1*in1 + _a2*in2 - _b1*out1 - _b2*out2;
+    in2 = in1;
+    in1 = in0;
+    out2 = out1;
+    out1 = out0;
+    phase++;
+    if(phase>=factor){
+      phase = 0;
+      out[nOut++] = out0;
+    }
+  }
+  _in1 = in1;
+  _in2 = in2;
+  _out1 = out1;
+  _out2 = out2;
+  _phase = phase;
+  return nOut;
+}
+
 
 void ButterworthLowPass2::getCoefficients(float coefficients[]){
   coefficients[0] = _gain;
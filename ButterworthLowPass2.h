@@ -67,6 +67,18 @@ public:
    @returns The filter output. */
   float updateF(int newVal);
 
+  /*! Submit a block of measurements to the filter and keep only one output in every "factor" samples (decimation, or downsampling).\n
+  Since this is a recursive filter every reading must still be filtered, but the state is kept in local variables for the whole block
+  and only the kept outputs are stored. The outputs are the same as from calling updateF() for each reading.
+  fRatio should be more than 2*factor to avoid aliasing. A factor of 1 gives a block version of updateF(), e.g. for the earlier elements of
+  an even-order filter where only the last element decimates.
+   @param in The new values.
+   @param nIn The number of values in the block.
+   @param factor The decimation factor. The kept output is the one after every factor-th reading, counting across blocks, so use the same factor for each block.
+   @param[out] out A buffer for the filter output, which needs space for nIn/factor + 1 values.
+   @returns The number of values written to out. */
+  int decimateF(int in[], int nIn, int factor, float out[]);
+
 /* Get the coefficients for the Butterworth Filter in use.
 The equation is out[i] = a0*in[i] + a1*in[i-1] + a2*in[i-2] - b1*out[i-1] - b2*out[i-2]
 where in[1] = gain * sample value (newVal as submitted to updateF()
@@ -97,6 +109,7 @@ private:
   boolean _updated;//has the filter received any data yet
   int _in1, _in2;//_in2 is input for i-2
   float _out1, _out2;//_out2 is output for i-2
+  int _phase;//number of readings since the last kept output from decimateF()
   
   void calculateCoefficients(float fRatio, int k, int N);//sets the member variables gain, a0,a1,a2,b1,b2. Used by both constructors
 };
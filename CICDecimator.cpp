@@ -0,0 +1,93 @@
+#include "CICDecimator.h"
+
+CICDecimator::CICDecimator(int factor, int stages, boolean burnIn){
+  if(factor<1){
+    _factor = 1;
+  }
+  else{
+    _factor = factor;
+  }
+  if(stages>CIC_DECIMATOR_MAX_STAGES){
+    _stages = CIC_DECIMATOR_MAX_STAGES;
+  }
+  else if(stages<1){
+    _stages = 1;
+  }
+  else{
+    _stages = stages;
+  }
+  //use as many stages as possible without the gain getting too large
+  _gain = 1;
+  for(int s=0; s<_stages; s++){
+    if(_gain*_factor>CIC_DECIMATOR_MAX_GAIN && s>0){
+      _stages = s;
+      break;
+    }
+    _gain*= _factor;
+  }
+  _correction = _gain/2;
+  for(int s=0; s<_stages; s++){
+    _integrators[s] = 0;
+    _combs[s] = 0;
+  }
+  _burnIn = burnIn;
+  _phase = 0;
+  _output = 0;
+  _updated=false;
+}
+
+int CICDecimator::decimate(int in[], int nIn, int out[]){
+  int nOut = 0;
+  for(int i=0; i<nIn; i++){
+    //This section is so that the state is initialised on first use.
+    if(!_updated){
+      _updated= true;
+      if(_burnIn){
+        //the impulse response is stages*factor readings long, so this many copies of the first reading fill the integrators and combs
+        //as if the input had always been constant. This also leaves _phase at 0.
+        for(long n=0; n<long(_stages)*_factor; n++){
+          accumulate(in[i]);
+        }
+      }
+    }
+    if(accumulate(in[i])){
+      out[nOut++] = _output;
+    }
+  }
+  return nOut;
+}
+
+int CICDecimator::getStages(){
+  return _stages;
+}
+
+//
+// private
+//
+boolean CICDecimator::accumulate(int newVal){
+  //integrators run at the input rate
+  _integrators[0]+= (unsigned long)long(newVal);
+  for(int s=1; s<_stages; s++){
+    _integrators[s]+= _integrators[s-1];
+  }
+  _phase++;
+  if(_phase<_factor){
+    return false;
+  }
+  //combs run at the output rate
+  _phase = 0;
+  unsigned long c = _integrators[_stages-1];
+  for(int s=0; s<_stages; s++){
+    unsigned long previous = _combs[s];
+    _combs[s] = c;
+    c-= previous;
+  }
+  //the comb output is within +/- 2^15 * _gain so it is correct as a signed value despite any overflow
+  if(long(c)<0){
+    _output = -int(((0UL-c)+_correction)/_gain);
+  }
+  else{
+    _output = int((c+_correction)/_gain);
+  }
+  return true;
+}
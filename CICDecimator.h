@@ -0,0 +1,81 @@
+/* CICDecimator.h - Cascaded Integrator-Comb Decimator
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * CICDecimator is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef CIC_DECIMATOR_H
+#define CIC_DECIMATOR_H
+
+#include "Arduino.h"
+
+#define CIC_DECIMATOR_MAX_STAGES 4 //!< Maximum number of integrator/comb pairs, as specified by the stages parameter in the constructor.
+#define CIC_DECIMATOR_MAX_GAIN 65536UL //!< Maximum of factor^stages, so that 16 bit readings cannot overflow the 32 bit arithmetic.
+
+/*!  This filter is equivalent to a cascade of "stages" moving averages of length "factor", keeping only one output in every "factor" samples
+ (decimation, or downsampling), but uses only integer addition and subtraction.\n
+Each reading is added into a chain of integrators (running sums). Once per output the last integrator is passed through a chain of combs,
+each of which subtracts its previous input, and the result is divided by the gain (factor^stages). The integrators overflow, but
+the overflows cancel out in the combs since the arithmetic is modulo 2^32.
+More stages give better attenuation above the cut-off but a longer delay.\n
+Readings are assumed to fit in 16 bits (as an int does on AVR), which is why factor^stages is limited to CIC_DECIMATOR_MAX_GAIN.\n
+See http://en.wikipedia.org/wiki/Cascaded_integrator-comb_filter \n
+ To use: create an instance of the filter and submit blocks of readings using decimate(). The kept output is the one after every factor-th reading,
+ counting across blocks, so blocks need not be a multiple of factor in length.
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A multi-stage moving average with decimation, in integer arithmetic. */
+class CICDecimator{
+public:
+  /*! Create the filter with specified parameters.
+   @param factor The decimation factor, i.e. the number of readings for each output.
+   @param stages The number of integrator/comb pairs with a maximum specified by CIC_DECIMATOR_MAX_STAGES.
+   This is silently reduced if factor^stages would exceed CIC_DECIMATOR_MAX_GAIN.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  CICDecimator(int factor, int stages, boolean burnIn);
+
+  /*! Submit a block of measurements to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param in The new values.
+   @param nIn The number of values in the block.
+   @param[out] out A buffer for the filter output, which needs space for nIn/factor + 1 values.
+   @returns The number of values written to out. */
+  int decimate(int in[], int nIn, int out[]);
+
+  /*! @returns The number of stages actually used, which may be less than the stages parameter in the constructor. */
+  int getStages();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+  int _factor;
+  int _stages;
+
+  boolean _updated;//has the filter received any data yet
+  unsigned long _integrators[CIC_DECIMATOR_MAX_STAGES];
+  unsigned long _combs[CIC_DECIMATOR_MAX_STAGES];//previous input to each comb
+  int _phase;//number of readings since the last kept output
+  unsigned long _gain;//factor^stages
+  unsigned long _correction;// _gain/2, gets added in to compensate for integer division
+  int _output;//set by accumulate() when it returns true
+
+  //common code used by decimate() and the burn-in
+  boolean accumulate(int newVal);
+
+};
+
+#endif
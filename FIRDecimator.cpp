@@ -0,0 +1,93 @@
+#include "FIRDecimator.h"
+
+FIRDecimator::FIRDecimator(float taps[], int nTaps, int factor, boolean burnIn){
+  init(nTaps, factor, burnIn);
+  for(int k=0; k<_length; k++){
+    _taps[k] = taps[k];
+  }
+}
+
+FIRDecimator::FIRDecimator(int length, int factor, boolean burnIn){
+  init(length, factor, burnIn);
+  for(int k=0; k<_length; k++){
+    _taps[k] = 1.0F/float(_length);
+  }
+}
+
+int FIRDecimator::decimateF(int in[], int nIn, float out[]){
+  int nOut = 0;
+  for(int i=0; i<nIn; i++){
+    //This section is so that the history of samples is initialised on first use.
+    if(!_updated){
+      _updated= true;
+      int fillVal = 0;
+      if(_burnIn){
+        fillVal = in[i];
+      }
+      for(int k=0; k<_length; k++){
+        _values[k]=fillVal;
+      }
+    }
+    //store the new value
+    _values[_index] = in[i];
+    _phase++;
+    if(_phase==_factor){
+      //this output is kept, so apply the taps working back from the newest value
+      _phase = 0;
+      float sum = 0.0F;
+      int pos = _index;
+      for(int k=0; k<_length; k++){
+        sum+= _taps[k]*_values[pos];
+        pos--;
+        if(pos<0){
+          pos = _length-1;
+        }
+      }
+      out[nOut++] = sum;
+    }
+    //increment the pointer, bringing back to 0 as required
+    _index++;
+    if(_index==_length){
+      _index = 0;
+    }
+  }
+  return nOut;
+}
+
+// debugging
+void FIRDecimator::getHistory(int values[]){
+  for(int i = 0; i<_length; i++){
+    values[i] = _values[i];
+  }
+}
+
+int FIRDecimator::getLastIndex(){
+  int lastIndex = _index-1;
+  if(lastIndex<0){
+    lastIndex = _length-1;
+  }
+  return lastIndex;
+}
+
+//
+// private
+//
+void FIRDecimator::init(int length, int factor, boolean burnIn){
+  //make sure the buffer length is within the allocated space
+  if(length>FIR_DECIMATOR_MAX_TAPS){
+    _length = FIR_DECIMATOR_MAX_TAPS;
+  }
+  else{
+    _length = length;
+  }
+  if(factor<1){
+    _factor = 1;
+  }
+  else{
+    _factor = factor;
+  }
+  _burnIn = burnIn;
+  _index = 0;
+  _phase = 0;
+  _updated=false;
+}
@@ -0,0 +1,87 @@
+/* FIRDecimator.h - Decimating Finite Impulse Response Filter
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * FIRDecimator is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef FIR_DECIMATOR_H
+#define FIR_DECIMATOR_H
+
+#include "Arduino.h"
+
+#define FIR_DECIMATOR_MAX_TAPS 25 //!< Maximum number of taps (coefficients), as specified by the nTaps or length parameter in the constructor.
+
+/*!  This filter applies a finite impulse response (FIR) low pass filter and keeps only one output in every "factor" samples,
+reducing the sample rate (decimation, or downsampling).\n
+Since the output of an FIR filter depends only on the inputs, the outputs which would be discarded are never calculated. Each input
+is only stored and the weighted sum over the taps is done once per kept output, so the cost is roughly 1/factor of filtering then discarding.
+This is equivalent to a polyphase decimator, where each tap is applied to only one phase of the input.\n
+The cut-off frequency of the filter should be below half the output sample rate to avoid aliasing. A moving average of length=factor is
+the simplest choice but has poor attenuation; see http://en.wikipedia.org/wiki/Decimation_(signal_processing) \n
+ To use: create an instance of the filter and submit blocks of readings using decimateF(). The kept output is the one after every factor-th reading,
+ counting across blocks, so blocks need not be a multiple of factor in length.
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A finite impulse response filter with decimation. */
+class FIRDecimator{
+public:
+  /*! Create the filter with specified parameters.
+   @param taps The filter coefficients, where taps[0] applies to the newest reading. These are copied, so the array need not be kept.
+   @param nTaps The number of coefficients with a maximum specified by FIR_DECIMATOR_MAX_TAPS.
+   @param factor The decimation factor, i.e. the number of readings for each output.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input*sum(taps) after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  FIRDecimator(float taps[], int nTaps, int factor, boolean burnIn);
+
+  /*! Create a decimating moving average, i.e. all taps are 1/length.
+   @param length The number of samples to take into account with a maximum specified by FIR_DECIMATOR_MAX_TAPS.
+   @param factor The decimation factor, i.e. the number of readings for each output.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading. */
+  FIRDecimator(int length, int factor, boolean burnIn);
+
+  /*! Submit a block of measurements to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param in The new values.
+   @param nIn The number of values in the block.
+   @param[out] out A buffer for the filter output, which needs space for nIn/factor + 1 values.
+   @returns The number of values written to out. */
+  int decimateF(int in[], int nIn, float out[]);
+
+  /*! Get the previously-submitted values. This is a "circular buffer" so the current pointer must be obtained using getLastIndex()
+  @param[out] values A buffer of length specified by the nTaps or length parameter in the constructor. */
+  void getHistory(int values[]);
+  /*! What was the last index used in the returned buffer from getHistory()?
+  @returns The index to the value submitted last */
+  int getLastIndex();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+  int _length;//number of taps
+  int _factor;
+  float _taps[FIR_DECIMATOR_MAX_TAPS];
+
+  boolean _updated;//has the filter received any data yet
+  int _values[FIR_DECIMATOR_MAX_TAPS];
+  int _index;// pointer into _values[]
+  int _phase;//number of readings since the last kept output
+
+  //common code used by both constructors
+  void init(int length, int factor, boolean burnIn);
+
+};
+
+#endif
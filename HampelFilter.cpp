@@ -0,0 +1,74 @@
+#include "HampelFilter.h"
+
+HampelFilter::HampelFilter(int length, float nSigma, boolean burnIn) : _median(length, burnIn){
+  _nSigma = nSigma;
+  _outlier = false;
+  _mad = 0;
+}
+
+int HampelFilter::update(int newVal){
+  int median = _median.update(newVal);
+  _mad = calcMAD(median);
+  long deviation = long(newVal)-long(median);
+  if(deviation<0){
+    deviation = -deviation;
+  }
+  _outlier = (float(deviation) > _nSigma*HAMPEL_MAD_SCALE*float(_mad));
+  if(_outlier){
+    return median;
+  }
+  return newVal;
+}
+
+boolean HampelFilter::isOutlier(){
+  return _outlier;
+}
+
+unsigned int HampelFilter::getMAD(){
+  return _mad;
+}
+
+// debugging
+void HampelFilter::getHistory(int values[]){
+  _median.getHistory(values);
+}
+
+int HampelFilter::getLastIndex(){
+  return _median.getLastIndex();
+}
+
+//
+// private
+//
+unsigned int HampelFilter::calcMAD(int median){
+  //The absolute deviations form two sorted lists: above[i] = sorted[mid+i]-median for i=0..mid
+  //and below[j] = median-sorted[mid-1-j] for j=0..mid-1. The MAD is the middle value of the two merged,
+  //i.e. the largest of the smallest (mid+1) deviations, which are the first i of above and the first (mid+1-i) of below.
+  //Binary search for the smallest i where taking one more from below would not give a smaller deviation.
+  int mid = _median.getLength()/2;
+  int take = mid+1;
+  int lo = 1;//below has only mid entries, so at least one must come from above
+  int hi = take;
+  while(lo<hi){
+    int i = (lo+hi)/2;
+    int j = take-i;
+    long nextAbove = long(_median.getRanked(mid+i))-median;
+    long lastBelow = long(median)-_median.getRanked(mid-j);
+    if(lastBelow>nextAbove){
+      lo = i+1;
+    }
+    else{
+      hi = i;
+    }
+  }
+  int i = lo;
+  int j = take-i;
+  long mad = long(_median.getRanked(mid+i-1))-median;
+  if(j>0){
+    long lastBelow = long(median)-_median.getRanked(mid-j);
+    if(lastBelow>mad){
+      mad = lastBelow;
+    }
+  }
+  return (unsigned int)mad;
+}
@@ -0,0 +1,79 @@
+/* HampelFilter.h - Hampel Outlier Filter
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * HampelFilter is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef HAMPEL_FILTER_H
+#define HAMPEL_FILTER_H
+
+#include "Arduino.h"
+#include "MedianFilter.h"
+
+#define HAMPEL_MAD_SCALE 1.4826F //!< Converts the median absolute deviation to an estimate of the standard deviation for normally-distributed data.
+
+/*!  This filter passes readings through unchanged unless they are outliers, in which case they are replaced by the median of the window.
+A reading is an outlier if it differs from the median of a set number of previous values by more than nSigma times the
+scaled median absolute deviation (MAD) of the same values. Unlike MedianFilter, readings which are not outliers are not delayed or smoothed.\n
+The window is held in sorted order by a MedianFilter, so the MAD is found by a binary search over the values either side of the median
+rather than by sorting the absolute deviations again for each sample.\n
+See http://en.wikipedia.org/wiki/Median_absolute_deviation \n
+ To use: create an instance of the filter and submit new readings using update(). Whether the last reading was replaced is given by isOutlier().
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A finite length outlier rejection filter. */
+class HampelFilter{
+public:
+  /*! Create the filter with specified parameters.
+   @param length The number of samples to take into account with a maximum specified by MEDIAN_MAX_LEN. This should be odd; even values will be silently increased by 1.
+   @param nSigma The threshold for an outlier, as a multiple of the estimated standard deviation (HAMPEL_MAD_SCALE*MAD). 3 is a typical value.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  HampelFilter(int length, float nSigma, boolean burnIn);
+
+  /*! Submit a new measurement to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param newVal The new value.
+   @returns The filter output, which is either newVal or the median if newVal is an outlier. */
+  int update(int newVal);
+
+  /*! Was the value submitted by the last update() an outlier?
+  @returns true if the value was replaced by the median. */
+  boolean isOutlier();
+  /*! @returns The median absolute deviation of the window as of the last update() */
+  unsigned int getMAD();
+
+  /*! Get the previously-submitted values. This is a "circular buffer" so the current pointer must be obtained using getLastIndex()
+  @param[out] values A buffer of length specified by the length parameter in the constructor. */
+  void getHistory(int values[]);
+  /*! What was the last index used in the returned buffer from getHistory()?
+  @returns The index to the value submitted by the last update() */
+  int getLastIndex();
+
+private:
+  //constructor parameters
+  float _nSigma;
+
+  MedianFilter _median;//holds the window in sorted order
+  boolean _outlier;
+  unsigned int _mad;
+
+  //find the median absolute deviation from the sorted window
+  unsigned int calcMAD(int median);
+
+};
+
+#endif
@@ -4,3 +4,11 @@
 #include "./SimpleHighPass.cpp"
 #include "./MedianFilter.cpp"
 #include "./ButterworthLowPass2.cpp"
+#include "./MovingMinMax.cpp"
+#include "./HampelFilter.cpp"
+#include "./RollingQuantiles.cpp"
+#include "./FIRDecimator.cpp"
+#include "./CICDecimator.cpp"
+#include "./RollupAggregate.cpp"
+#include "./WeightedMovingAverage.cpp"
+#include "./SavitzkyGolay.cpp"
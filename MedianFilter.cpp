@@ -114,6 +114,14 @@ int MedianFilter::getLastIndex(){
   return lastIndex;
 }
 
+int MedianFilter::getRanked(int rank){
+  return _values[_sortList[rank]];
+}
+
+int MedianFilter::getLength(){
+  return _length;
+}
+
 
 
 
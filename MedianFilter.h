@@ -53,6 +53,15 @@ public:
   @returns The index to the value submitted by the last update() */
   int getLastIndex();
 
+  /*! Get a value from the window by its position in sorted order, as of the last update().
+  The median returned by update() is getRanked(getLength()/2).
+  @param rank The position in the sorted window, from 0 (the smallest value) to getLength()-1 (the largest value).
+  @returns The value at that rank. */
+  int getRanked(int rank);
+  /*! How many samples are in the window? This may differ from the length parameter in the constructor, which is limited to MEDIAN_MAX_LEN and made odd.
+  @returns The number of samples over which the median is found. */
+  int getLength();
+
 private:
   //constructor parameters
   boolean _burnIn;
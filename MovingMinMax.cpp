@@ -0,0 +1,106 @@
+#include "MovingMinMax.h"
+
+MovingMinMax::MovingMinMax(int length, boolean burnIn){
+  //make sure the buffer length is within the allocated space
+  if(length>MOVING_MIN_MAX_MAX_LEN){
+    _length = MOVING_MIN_MAX_MAX_LEN;
+  }
+  else{
+    _length = length;
+  }
+  _burnIn = burnIn;
+  _index = 0;
+  _minHead = 0;
+  _minCount = 0;
+  _maxHead = 0;
+  _maxCount = 0;
+  _updated=false;
+}
+
+int MovingMinMax::update(int newVal){
+  //This section is so that the history of samples is initialised on first use.
+  if(!_updated){
+    _updated= true;
+    int fillVal = 0;
+    if(_burnIn){
+      //fill _values with newVal rather than zeros such that min and max start as newVal
+      fillVal = newVal;
+    }
+    for(int i=0; i<_length; i++){
+      _values[i]=fillVal;
+    }
+    //all values are the same so only the most recent (i.e. the one before _index) needs to be in the deques
+    _minHead = 0;
+    _minCount = 1;
+    _minDeque[0] = _length-1;
+    _maxHead = 0;
+    _maxCount = 1;
+    _maxDeque[0] = _length-1;
+  }
+
+  //the value at _index is about to be replaced, so it leaves the window. If it is in a deque it must be the oldest entry.
+  if(_minCount>0 && _minDeque[_minHead]==_index){
+    _minHead = (_minHead+1)%_length;
+    _minCount--;
+  }
+  if(_maxCount>0 && _maxDeque[_maxHead]==_index){
+    _maxHead = (_maxHead+1)%_length;
+    _maxCount--;
+  }
+  //store the new value
+  _values[_index] = newVal;
+  pushBack();
+  //increment the pointer, bringing back to 0 as required
+  _index++;
+  _index = _index%_length;
+
+  return getMax()-getMin();
+}
+
+int MovingMinMax::getMin(){
+  if(_minCount==0){
+    return 0;
+  }
+  return _values[_minDeque[_minHead]];
+}
+
+int MovingMinMax::getMax(){
+  if(_maxCount==0){
+    return 0;
+  }
+  return _values[_maxDeque[_maxHead]];
+}
+
+// debugging
+void MovingMinMax::getHistory(int values[]){
+  for(int i = 0; i<_length; i++){
+    values[i] = _values[i];
+  }
+}
+
+int MovingMinMax::getLastIndex(){
+  int lastIndex = _index-1;
+  if(lastIndex<0){
+    lastIndex = _length-1;
+  }
+  return lastIndex;
+}
+
+//
+// private
+//
+void MovingMinMax::pushBack(){
+  int newVal = _values[_index];
+  //older entries which are not smaller than newVal can never be the minimum again, so discard them from the newest end
+  while(_minCount>0 && _values[_minDeque[(_minHead+_minCount-1)%_length]]>=newVal){
+    _minCount--;
+  }
+  _minDeque[(_minHead+_minCount)%_length] = _index;
+  _minCount++;
+  //likewise older entries which are not larger than newVal can never be the maximum again
+  while(_maxCount>0 && _values[_maxDeque[(_maxHead+_maxCount-1)%_length]]<=newVal){
+    _maxCount--;
+  }
+  _maxDeque[(_maxHead+_maxCount)%_length] = _index;
+  _maxCount++;
+}
@@ -0,0 +1,83 @@
+/* MovingMinMax.h - Sliding Window Minimum/Maximum
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * MovingMinMax is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef MOVING_MIN_MAX_H
+#define MOVING_MIN_MAX_H
+
+#include "Arduino.h"
+
+#define MOVING_MIN_MAX_MAX_LEN 64 //!< Maximum number of samples, as specified by the length parameter in the constructor. Absolute max is 256.
+
+/*!  This filter tracks the minimum, maximum and range (max-min) of a set number of previous values.
+This gives an envelope of the signal, which is useful for peak detection or for estimating the amplitude of a noisy signal.\n
+Each of the minimum and maximum is maintained as a "monotonic deque" of the samples which could still become the
+extreme value before leaving the window. The current extreme is always at the front of its deque, and each sample is
+added to and removed from each deque at most once.\n
+See http://www.richardhartersworld.com/cri/2001/slidingmin.html \n
+ To use: create an instance of the filter and submit new readings using update(). The min and max are then available from getMin() and getMax().
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A finite length sliding minimum, maximum and range. */
+class MovingMinMax{
+public:
+  /*! Create the filter with specified parameters.
+   @param length The number of samples to take into account with a maximum specified by MOVING_MIN_MAX_MAX_LEN.
+   @param burnIn Whether to initialise the filter on first reading such that min = max = the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  MovingMinMax(int length, boolean burnIn);
+
+  /*! Submit a new measurement to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param newVal The new value.
+   @returns The filter output, which is the range (max-min) of the values in the window. */
+  int update(int newVal);
+
+  /*! @returns The smallest value in the window as of the last update() */
+  int getMin();
+  /*! @returns The largest value in the window as of the last update() */
+  int getMax();
+
+  /*! Get the previously-submitted values. This is a "circular buffer" so the current pointer must be obtained using getLastIndex()
+  @param[out] values A buffer of length specified by the length parameter in the constructor. */
+  void getHistory(int values[]);
+  /*! What was the last index used in the returned buffer from getHistory()?
+  @returns The index to the value submitted by the last update() */
+  int getLastIndex();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+  int _length;
+
+  boolean _updated;//has the filter received any data yet
+  int _values[MOVING_MIN_MAX_MAX_LEN];
+  int _index;// pointer into _values[]
+  //the deques are circular buffers of pointers into _values[], oldest first.
+  //values pointed to by _minDeque are increasing and values pointed to by _maxDeque are decreasing
+  byte _minDeque[MOVING_MIN_MAX_MAX_LEN];
+  byte _maxDeque[MOVING_MIN_MAX_MAX_LEN];
+  int _minHead, _minCount;//position of the oldest entry and number of entries in _minDeque
+  int _maxHead, _maxCount;
+
+  //add _values[_index] to the deques, having removed entries that can no longer be the min/max
+  void pushBack();
+
+};
+
+#endif
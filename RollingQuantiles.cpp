@@ -0,0 +1,233 @@
+#include "RollingQuantiles.h"
+
+RollingQuantiles::RollingQuantiles(int length, float quantiles[], int nQuantiles, boolean burnIn){
+  _approximate = false;
+  _minVal = 0;
+  _binWidth = 1;
+  init(length, quantiles, nQuantiles, burnIn);
+}
+
+RollingQuantiles::RollingQuantiles(int length, float quantiles[], int nQuantiles, int minVal, int binWidth, boolean burnIn){
+  _approximate = true;
+  _minVal = minVal;
+  if(binWidth<1){
+    _binWidth = 1;
+  }
+  else{
+    _binWidth = binWidth;
+  }
+  init(length, quantiles, nQuantiles, burnIn);
+}
+
+int RollingQuantiles::update(int newVal){
+  //This section is so that the history of samples is initialised on first use.
+  if(!_updated){
+    _updated= true;
+    int fillVal = 0;
+    if(_burnIn){
+      //fill the window with newVal rather than zeros such that the quantiles start as newVal
+      fillVal = newVal;
+    }
+    if(_approximate){
+      byte fillBin = binOf(fillVal);
+      for(int i=0; i<_length; i++){
+        _window.approx.bins[i]=fillBin;
+      }
+      for(int i=0; i<ROLLING_QUANTILES_BINS; i++){
+        _window.approx.tree[i]=0;
+      }
+      addToBin(fillBin, _length);
+    }
+    else{
+      for(int i=0; i<_length; i++){
+        _window.exact.values[i]=fillVal;
+        _window.exact.order[i]=fillVal;
+      }
+    }
+  }
+
+  if(_approximate){
+    //move one count from the bin of the replaced value to the bin of newVal
+    int oldBin = _window.approx.bins[_index];
+    int newBin = binOf(newVal);
+    if(oldBin!=newBin){
+      addToBin(oldBin, -1);
+      addToBin(newBin, 1);
+    }
+    //store the bin of the new value
+    _window.approx.bins[_index] = newBin;
+  }
+  else{
+    //replace oldVal with newVal in the sorted list, shifting along only the values between them
+    int* order = _window.exact.order;
+    int oldVal = _window.exact.values[_index];
+    int oldPos = lowerBound(oldVal);
+    if(newVal>=oldVal){
+      int newPos = upperBound(newVal)-1;
+      memmove(&order[oldPos], &order[oldPos+1], (newPos-oldPos)*sizeof(int));
+      order[newPos] = newVal;
+    }
+    else{
+      int newPos = lowerBound(newVal);
+      memmove(&order[newPos+1], &order[newPos], (oldPos-newPos)*sizeof(int));
+      order[newPos] = newVal;
+    }
+    //store the new value
+    _window.exact.values[_index] = newVal;
+  }
+  //increment the pointer, bringing back to 0 as required
+  _index++;
+  _index = _index%_length;
+
+  return rankedValue(_medianRank);
+}
+
+int RollingQuantiles::getQuantile(int i){
+  return rankedValue(_ranks[i]);
+}
+
+void RollingQuantiles::getQuantiles(int values[]){
+  for(int i = 0; i<_nQuantiles; i++){
+    values[i] = rankedValue(_ranks[i]);
+  }
+}
+
+int RollingQuantiles::getIQR(){
+  return rankedValue(_q3Rank)-rankedValue(_q1Rank);
+}
+
+// debugging
+void RollingQuantiles::getHistory(int values[]){
+  for(int i = 0; i<_length; i++){
+    if(_approximate){
+      values[i] = binValue(_window.approx.bins[i]);
+    }
+    else{
+      values[i] = _window.exact.values[i];
+    }
+  }
+}
+
+int RollingQuantiles::getLastIndex(){
+  int lastIndex = _index-1;
+  if(lastIndex<0){
+    lastIndex = _length-1;
+  }
+  return lastIndex;
+}
+
+//
+// private
+//
+void RollingQuantiles::init(int length, float quantiles[], int nQuantiles, boolean burnIn){
+  //make sure the buffer lengths are within the allocated space
+  int maxLength = ROLLING_QUANTILES_MAX_LEN;
+  if(_approximate){
+    maxLength = ROLLING_QUANTILES_APPROX_MAX_LEN;
+  }
+  if(length>maxLength){
+    _length = maxLength;
+  }
+  else{
+    _length = length;
+  }
+  if(nQuantiles>ROLLING_QUANTILES_MAX_RANKS){
+    _nQuantiles = ROLLING_QUANTILES_MAX_RANKS;
+  }
+  else{
+    _nQuantiles = nQuantiles;
+  }
+  //the rank of each quantile is fixed by the length, so work them out now rather than on every look-up
+  for(int i=0; i<_nQuantiles; i++){
+    _ranks[i] = quantileRank(quantiles[i]);
+  }
+  _medianRank = quantileRank(0.5F);
+  _q1Rank = quantileRank(0.25F);
+  _q3Rank = quantileRank(0.75F);
+  _burnIn = burnIn;
+  _index = 0;
+  _updated=false;
+}
+
+int RollingQuantiles::quantileRank(float quantile){
+  if(quantile<0.0F){
+    quantile = 0.0F;
+  }
+  if(quantile>1.0F){
+    quantile = 1.0F;
+  }
+  return int(quantile*float(_length-1)+0.5F);
+}
+
+int RollingQuantiles::rankedValue(int rank){
+  if(!_approximate){
+    return _window.exact.order[rank];
+  }
+  //descend the Fenwick tree to find the first bin where the cumulative count exceeds rank
+  int bin = 0;
+  for(int step=ROLLING_QUANTILES_BINS; step>0; step>>=1){
+    if(bin+step<=ROLLING_QUANTILES_BINS && _window.approx.tree[bin+step-1]<=rank){
+      bin+=step;
+      rank-=_window.approx.tree[bin-1];
+    }
+  }
+  if(bin==ROLLING_QUANTILES_BINS){
+    bin--;//not possible once the bins hold _length values, since rank<_length
+  }
+  return binValue(bin);
+}
+
+int RollingQuantiles::lowerBound(int val){
+  //first position in _window.exact.order[] with a value not less than val
+  int lo = 0;
+  int hi = _length;
+  while(lo<hi){
+    int mid = (lo+hi)/2;
+    if(_window.exact.order[mid]<val){
+      lo = mid+1;
+    }
+    else{
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+int RollingQuantiles::upperBound(int val){
+  //first position in _window.exact.order[] with a value greater than val
+  int lo = 0;
+  int hi = _length;
+  while(lo<hi){
+    int mid = (lo+hi)/2;
+    if(_window.exact.order[mid]<=val){
+      lo = mid+1;
+    }
+    else{
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+int RollingQuantiles::binOf(int val){
+  long bin = (long(val)-_minVal)/_binWidth;
+  if(bin<0){
+    return 0;
+  }
+  if(bin>=ROLLING_QUANTILES_BINS){
+    return ROLLING_QUANTILES_BINS-1;
+  }
+  return int(bin);
+}
+
+int RollingQuantiles::binValue(int bin){
+  //use the middle of the bin
+  return int(long(_minVal) + long(bin)*_binWidth + _binWidth/2);
+}
+
+void RollingQuantiles::addToBin(int bin, int count){
+  //Fenwick tree entry i (counting from 1) is stored in tree[i-1]
+  for(int i=bin+1; i<=ROLLING_QUANTILES_BINS; i+= i&(-i)){
+    _window.approx.tree[i-1]+=count;
+  }
+}
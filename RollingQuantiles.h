@@ -0,0 +1,137 @@
+/* RollingQuantiles.h - Multiple Quantiles of a Sliding Window
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * RollingQuantiles is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef ROLLING_QUANTILES_H
+#define ROLLING_QUANTILES_H
+
+#include "Arduino.h"
+
+#define ROLLING_QUANTILES_MAX_LEN 128 //!< Maximum number of samples in exact mode, as specified by the length parameter in the constructor. Each sample uses 2 ints of memory.
+#define ROLLING_QUANTILES_APPROX_MAX_LEN 384 //!< Maximum number of samples in approximate mode, as specified by the length parameter in the constructor. Each sample uses 1 byte of memory. With 2 byte ints and the default ROLLING_QUANTILES_BINS this uses no more memory than exact mode.
+#define ROLLING_QUANTILES_MAX_RANKS 8 //!< Maximum number of quantiles, as specified by the nQuantiles parameter in the constructor.
+#define ROLLING_QUANTILES_BINS 64 //!< Number of value bins used by the approximate mode. Must be a power of 2 and not more than 256.
+
+#if ROLLING_QUANTILES_BINS > 256
+  #error "ROLLING_QUANTILES_BINS must not be more than 256"
+#endif
+#if (ROLLING_QUANTILES_BINS & (ROLLING_QUANTILES_BINS-1)) != 0
+  #error "ROLLING_QUANTILES_BINS must be a power of 2"
+#endif
+
+/*!  This filter calculates several quantiles (e.g. the 5th percentile, median and 95th percentile) of a set number of previous values
+from a single window, which is cheaper than using a MedianFilter-like filter for each quantile.\n
+In exact mode the window is kept in sorted order. Each update finds the outgoing and incoming values by binary search and shifts only
+the values between them, after which any quantile is a direct look-up. The window can be up to ROLLING_QUANTILES_MAX_LEN samples,
+around 5 times MEDIAN_MAX_LEN.\n
+In approximate mode only the bin of each value is kept, where there are ROLLING_QUANTILES_BINS bins of equal width, and the number
+of values in each bin is held in a Fenwick tree (see http://en.wikipedia.org/wiki/Fenwick_tree). An update or quantile look-up then
+costs one step per bit of the number of bins, whatever the length, and the window can be up to ROLLING_QUANTILES_APPROX_MAX_LEN samples,
+around 15 times MEDIAN_MAX_LEN. The quantiles are the mid-points of the bins, so the error is at most half the bin width provided the value
+at the quantile is inside the range of the bins (minVal to minVal+ROLLING_QUANTILES_BINS*binWidth). Values outside the range are counted in
+the first or last bin, so a quantile in either of those bins may be out by any amount; choose the range to cover the expected readings.\n
+Quantile q is taken as the value with rank round(q*(length-1)) in the sorted window.\n
+See http://en.wikipedia.org/wiki/Quantile \n
+ To use: create an instance of the filter and submit new readings using update(). The configured quantiles are then available from getQuantile().
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A finite length filter giving several quantiles and the interquartile range. */
+class RollingQuantiles{
+public:
+  /*! Create the filter with specified parameters, in exact mode.
+   @param length The number of samples to take into account with a maximum specified by ROLLING_QUANTILES_MAX_LEN.
+   @param quantiles The quantiles to calculate, each in the range 0 to 1 (e.g. 0.05 for the 5th percentile). These are copied, so the array need not be kept.
+   @param nQuantiles The number of entries in quantiles, with a maximum specified by ROLLING_QUANTILES_MAX_RANKS.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  RollingQuantiles(int length, float quantiles[], int nQuantiles, boolean burnIn);
+
+  /*! Create the filter with specified parameters, in approximate mode.
+  Otherwise than this, behaviour is exactly as the exact mode filter.
+   @param length The number of samples to take into account with a maximum specified by ROLLING_QUANTILES_APPROX_MAX_LEN.
+   @param quantiles The quantiles to calculate, each in the range 0 to 1.
+   @param nQuantiles The number of entries in quantiles, with a maximum specified by ROLLING_QUANTILES_MAX_RANKS.
+   @param minVal The lowest value of the first bin. Values below this are counted in the first bin.
+   @param binWidth The range of values in each bin. Values above minVal + ROLLING_QUANTILES_BINS*binWidth are counted in the last bin.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading. */
+  RollingQuantiles(int length, float quantiles[], int nQuantiles, int minVal, int binWidth, boolean burnIn);
+
+  /*! Submit a new measurement to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param newVal The new value.
+   @returns The filter output, which is the median. */
+  int update(int newVal);
+
+  /*! Get one of the quantiles given in the constructor, as of the last update().
+  @param i Which quantile, from 0 to nQuantiles-1 (in the order given in the constructor).
+  @returns The value of the quantile. */
+  int getQuantile(int i);
+  /*! Get all of the quantiles given in the constructor, as of the last update().
+  @param[out] values A buffer of length specified by the nQuantiles parameter in the constructor. */
+  void getQuantiles(int values[]);
+  /*! @returns The interquartile range (75th percentile - 25th percentile) as of the last update() */
+  int getIQR();
+
+  /*! Get the previously-submitted values. This is a "circular buffer" so the current pointer must be obtained using getLastIndex()
+  In approximate mode the values are the mid-points of their bins, since the values themselves are not kept.
+  @param[out] values A buffer of length specified by the length parameter in the constructor. */
+  void getHistory(int values[]);
+  /*! What was the last index used in the returned buffer from getHistory()?
+  @returns The index to the value submitted by the last update() */
+  int getLastIndex();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+  int _length;
+  int _nQuantiles;
+  boolean _approximate;
+  int _minVal, _binWidth;//approximate mode only
+
+  boolean _updated;//has the filter received any data yet
+  int _index;// pointer into _window.exact.values[] or _window.approx.bins[]
+  //only one mode is used by an instance, so the modes share memory
+  union{
+    struct{
+      int values[ROLLING_QUANTILES_MAX_LEN];
+      int order[ROLLING_QUANTILES_MAX_LEN];//the values in ascending order
+    } exact;
+    struct{
+      byte bins[ROLLING_QUANTILES_APPROX_MAX_LEN];//the bin of each value
+      int tree[ROLLING_QUANTILES_BINS];//Fenwick tree of the number of values in each bin
+    } approx;
+  } _window;
+  int _ranks[ROLLING_QUANTILES_MAX_RANKS];//position in the sorted window of each quantile
+  int _medianRank, _q1Rank, _q3Rank;
+
+  //common code used by both constructors
+  void init(int length, float quantiles[], int nQuantiles, boolean burnIn);
+  int quantileRank(float quantile);
+  //find the value with the given position in the sorted window
+  int rankedValue(int rank);
+  //exact mode
+  int lowerBound(int val);
+  int upperBound(int val);
+  //approximate mode
+  int binOf(int val);
+  int binValue(int bin);
+  void addToBin(int bin, int count);
+
+};
+
+#endif
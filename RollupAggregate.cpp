@@ -0,0 +1,154 @@
+#include "RollupAggregate.h"
+
+#if ROLLUP_BUCKETS < 2
+  #error "ROLLUP_BUCKETS must be at least 2"
+#endif
+
+RollupAggregate::RollupAggregate(boolean burnIn){
+  _burnIn = burnIn;
+  _total = 0;
+  _mean = 0.0F;
+  _min = 0;
+  _max = 0;
+  _lastWindow = 0;
+  _lastTotal = 0;
+  _updated=false;
+}
+
+void RollupAggregate::update(int newVal){
+  //This section is so that the history of samples is initialised on first use.
+  if(!_updated){
+    _updated= true;
+    int fillVal = 0;
+    if(_burnIn){
+      //fill with newVal rather than zeros such that every window starts as newVal
+      fillVal = newVal;
+    }
+    for(int l=0; l<ROLLUP_LEVELS; l++){
+      for(int b=0; b<ROLLUP_BUCKETS; b++){
+        _sums[l][b] = long(fillVal)*(1L<<l);
+        _mins[l][b] = fillVal;
+        _maxs[l][b] = fillVal;
+      }
+      _heads[l] = ROLLUP_BUCKETS-1;
+    }
+    //this is a whole number of buckets at every level, so the next reading starts a new bucket at every level
+    _total = (unsigned long)ROLLUP_BUCKETS<<(ROLLUP_LEVELS-1);
+  }
+
+  //every reading is a bucket at level 0
+  _total++;
+  push(0, newVal, newVal, newVal);
+  //whenever a level has an even number of buckets, the newest two complete a bucket at the next level
+  for(int l=0; l<ROLLUP_LEVELS-1; l++){
+    if((_total>>l)&1){
+      break;
+    }
+    int newest = bucketIndex(l, 0);
+    int older = bucketIndex(l, 1);
+    push(l+1, _sums[l][newest]+_sums[l][older],
+      min(_mins[l][newest], _mins[l][older]),
+      max(_maxs[l][newest], _maxs[l][older]));
+  }
+}
+
+float RollupAggregate::getMean(unsigned long window){
+  aggregate(window);
+  return _mean;
+}
+
+int RollupAggregate::getMin(unsigned long window){
+  aggregate(window);
+  return _min;
+}
+
+int RollupAggregate::getMax(unsigned long window){
+  aggregate(window);
+  return _max;
+}
+
+unsigned long RollupAggregate::getMaxWindow(){
+  return (unsigned long)ROLLUP_BUCKETS<<(ROLLUP_LEVELS-1);
+}
+
+//
+// private
+//
+void RollupAggregate::push(int level, long sum, int minVal, int maxVal){
+  int head = _heads[level]+1;
+  if(head==ROLLUP_BUCKETS){
+    head = 0;
+  }
+  _heads[level] = head;
+  _sums[level][head] = sum;
+  _mins[level][head] = minVal;
+  _maxs[level][head] = maxVal;
+}
+
+int RollupAggregate::bucketIndex(int level, int back){
+  int index = _heads[level]-back;
+  if(index<0){
+    index+= ROLLUP_BUCKETS;
+  }
+  return index;
+}
+
+void RollupAggregate::include(int level, int back, float fraction){
+  int b = bucketIndex(level, back);
+  _mean+= fraction*float(_sums[level][b]);
+  if(_mins[level][b]<_min){
+    _min = _mins[level][b];
+  }
+  if(_maxs[level][b]>_max){
+    _max = _maxs[level][b];
+  }
+}
+
+void RollupAggregate::aggregate(unsigned long window){
+  if(window<1){
+    window = 1;
+  }
+  if(window>getMaxWindow()){
+    window = getMaxWindow();
+  }
+  if(!_updated){
+    _mean = 0.0F;
+    _min = 0;
+    _max = 0;
+    return;
+  }
+  //getMean(), getMin() and getMax() are often used together for the same window, so keep the results until the next update()
+  if(window==_lastWindow && _total==_lastTotal){
+    return;
+  }
+  _lastWindow = window;
+  _lastTotal = _total;
+  //_mean accumulates the sum until the end. Start _min and _max from the newest reading, which is in every window
+  _mean = 0.0F;
+  _min = _mins[0][_heads[0]];
+  _max = _maxs[0][_heads[0]];
+
+  //work back from the newest reading. At each level the newest bucket ends where the levels below left off.
+  unsigned long remaining = window;
+  for(int l=0; l<ROLLUP_LEVELS && remaining>0; l++){
+    unsigned long size = 1UL<<l;
+    if((remaining+size-1)/size<=ROLLUP_BUCKETS || l==ROLLUP_LEVELS-1){
+      //the rest of the window is within the buckets at this level
+      int whole = remaining/size;
+      for(int b=0; b<whole; b++){
+        include(l, b, 1.0F);
+      }
+      unsigned long part = remaining-whole*size;
+      if(part>0){
+        include(l, whole, float(part)/float(size));
+      }
+      remaining = 0;
+    }
+    else if((_total>>l)&1){
+      //there is an odd bucket at this level which is not yet part of a bucket at the next level
+      include(l, 0, 1.0F);
+      remaining-= size;
+    }
+  }
+  _mean/= float(window);
+}
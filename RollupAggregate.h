@@ -0,0 +1,99 @@
+/* RollupAggregate.h - Multi-Resolution Rolling Mean/Min/Max
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * RollupAggregate is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef ROLLUP_AGGREGATE_H
+#define ROLLUP_AGGREGATE_H
+
+#include "Arduino.h"
+
+#define ROLLUP_LEVELS 10 //!< Number of levels in the pyramid. The longest window is ROLLUP_BUCKETS * 2^(ROLLUP_LEVELS-1) samples.
+#define ROLLUP_BUCKETS 8 //!< Number of buckets kept at each level, minimum 2. Each bucket uses 8 bytes of memory.
+
+/*!  This keeps summaries of previous values from which the mean, minimum and maximum over any number of the most recent samples
+can be found, so one instance can serve several window lengths (e.g. 1 second, 1 minute and 1 hour).\n
+The summaries are a pyramid of levels. Each level keeps the sum, minimum and maximum of its most recent ROLLUP_BUCKETS "buckets"
+of samples, where a bucket at level 0 is one sample and a bucket at each higher level combines two buckets from the level below.
+Memory therefore grows with the logarithm of the longest window rather than its length, and each update costs one bucket
+on average. A query takes the newest buckets from each level, moving up a level whenever the window is too long for the buckets
+remaining, so it costs at most ROLLUP_LEVELS+ROLLUP_BUCKETS buckets.\n
+Windows of up to ROLLUP_BUCKETS samples are exact. Longer windows may end part-way through the oldest bucket used, which spans at most
+2/ROLLUP_BUCKETS of the window. The mean counts the appropriate fraction of that bucket's sum, and the min and max include the whole
+bucket (so they cover a window slightly longer than requested).\n
+See http://en.wikipedia.org/wiki/Pyramid_(image_processing) for the same idea applied to images.\n
+ To use: create an instance and submit new readings using update(), then use getMean(), getMin() and getMax() with the required window lengths.
+ Using getMean(), getMin() and getMax() together for the same window length between updates only combines the summaries once.
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  Moving average, minimum and maximum over any window length from one set of summaries. */
+class RollupAggregate{
+public:
+  /*! Create the aggregate with specified parameters.
+   @param burnIn Whether to initialise on first reading such that all windows hold the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  RollupAggregate(boolean burnIn);
+
+  /*! Submit a new measurement.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param newVal The new value. */
+  void update(int newVal);
+
+  /*! Get the mean of the most recent readings.
+   @param window The number of readings, from 1 to getMaxWindow(). Values outside this range are silently limited.
+   @returns The mean. */
+  float getMean(unsigned long window);
+  /*! Get the smallest of the most recent readings.
+   @param window The number of readings, from 1 to getMaxWindow(). Values outside this range are silently limited.
+   @returns The minimum. */
+  int getMin(unsigned long window);
+  /*! Get the largest of the most recent readings.
+   @param window The number of readings, from 1 to getMaxWindow(). Values outside this range are silently limited.
+   @returns The maximum. */
+  int getMax(unsigned long window);
+
+  /*! @returns The longest window which can be used with getMean(), getMin() and getMax(). */
+  unsigned long getMaxWindow();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+
+  boolean _updated;//has the filter received any data yet
+  unsigned long _total;//number of readings, starting from ROLLUP_BUCKETS*2^(ROLLUP_LEVELS-1) so all levels are filled by the initialisation
+  //each level is a circular buffer of buckets, with the newest at _heads[]
+  long _sums[ROLLUP_LEVELS][ROLLUP_BUCKETS];
+  int _mins[ROLLUP_LEVELS][ROLLUP_BUCKETS];
+  int _maxs[ROLLUP_LEVELS][ROLLUP_BUCKETS];
+  byte _heads[ROLLUP_LEVELS];
+  //the results of the last aggregate(), and the window and _total they are for
+  float _mean;
+  int _min, _max;
+  unsigned long _lastWindow, _lastTotal;
+
+  //add a bucket as the newest at a level
+  void push(int level, long sum, int minVal, int maxVal);
+  //find the position of a bucket in the circular buffer, counting back from the newest (back=0)
+  int bucketIndex(int level, int back);
+  //include a bucket in the results of aggregate()
+  void include(int level, int back, float fraction);
+  //common code used by getMean(), getMin() and getMax(). Sets _mean, _min and _max unless they are already for this window
+  void aggregate(unsigned long window);
+
+};
+
+#endif
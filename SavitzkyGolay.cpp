@@ -0,0 +1,110 @@
+#include "SavitzkyGolay.h"
+
+SavitzkyGolay::SavitzkyGolay(int length, boolean burnIn){
+  //make sure the buffer length is within the allocated space
+  if(length>SAVITZKY_GOLAY_MAX_LEN){
+    _length = SAVITZKY_GOLAY_MAX_LEN;
+  }
+  else{
+    _length = length;
+  }
+  //use an odd number so there is a middle value to fit at
+  if(_length%2 == 0){
+    if(length==SAVITZKY_GOLAY_MAX_LEN){
+      _length--;
+    }
+    else{
+      _length++;
+    }
+  }
+  //these only depend on the length. With t running from -m to m they are symmetric, so the sums of t and t^3 are zero.
+  long long m = _length/2;
+  _p2 = m*(m+1)*(2*m+1)/3;
+  _p4 = m*(m+1)*(2*m+1)*(3*m*m+3*m-1)/15;
+  _det = _length*_p4 - _p2*_p2;
+  _burnIn = burnIn;
+  _index = 0;
+  _a = 0.0F;
+  _b = 0.0F;
+  _c = 0.0F;
+  _updated=false;
+}
+
+float SavitzkyGolay::updateF(int newVal){
+  long long n1 = _length-1;
+  //This section is so that the history of samples is initialised on first use.
+  if(!_updated){
+    _updated= true;
+    int fillVal = 0;
+    if(_burnIn){
+      //fill _values with newVal rather than zeros such that the return value starts as newVal
+      fillVal = newVal;
+    }
+    for(int i=0; i<_length; i++){
+      _values[i]=fillVal;
+    }
+    _sum0 = long(fillVal)*_length;
+    _sum1 = fillVal*(n1*_length/2);
+    _sum2 = fillVal*(n1*_length*(2*n1+1)/6);
+  }
+
+  //This is where accumulation happens
+  //the oldest value leaves and every other value moves down one place (k becomes k-1), so
+  //sum(k^2*x) loses 2*sum(k*x) - sum(x) and sum(k*x) loses sum(x). newVal comes in at k=length-1.
+  long remaining = _sum0-_values[_index];
+  _sum2+= -2*_sum1 + remaining + n1*n1*newVal;
+  _sum1+= -remaining + n1*newVal;
+  _sum0 = remaining+newVal;
+  //store the new value
+  _values[_index] = newVal;
+  //increment the pointer, bringing back to 0 as required
+  _index++;
+  _index = _index%_length;
+
+  //move the sums to be about the middle of the window, which makes the least-squares equations simpler. These are still exact.
+  long long m = _length/2;
+  long long t1 = _sum1 - m*_sum0;
+  long long t2 = _sum2 - 2*m*_sum1 + m*m*_sum0;
+  //solve the least-squares equations: a*length + c*p2 = sum(x); b*p2 = sum(t*x); a*p2 + c*p4 = sum(t^2*x)
+  if(_det==0){
+    //length 1: the fit is just the value
+    _a = newVal;
+    _b = 0.0F;
+    _c = 0.0F;
+  }
+  else{
+    _a = float(_p4*_sum0 - _p2*t2)/float(_det);
+    _b = float(t1)/float(_p2);
+    _c = float(_length*t2 - _p2*_sum0)/float(_det);
+  }
+  return _a;
+}
+
+float SavitzkyGolay::getSlope(){
+  return _b;
+}
+
+float SavitzkyGolay::getEndValue(){
+  float m = _length/2;
+  return _a + _b*m + _c*m*m;
+}
+
+float SavitzkyGolay::getEndSlope(){
+  float m = _length/2;
+  return _b + 2.0F*_c*m;
+}
+
+// debugging
+void SavitzkyGolay::getHistory(int values[]){
+  for(int i = 0; i<_length; i++){
+    values[i] = _values[i];
+  }
+}
+
+int SavitzkyGolay::getLastIndex(){
+  int lastIndex = _index-1;
+  if(lastIndex<0){
+    lastIndex = _length-1;
+  }
+  return lastIndex;
+}
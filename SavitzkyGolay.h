@@ -0,0 +1,86 @@
+/* SavitzkyGolay.h - Savitzky-Golay Smoothing and Differentiation
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * SavitzkyGolay is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef SAVITZKY_GOLAY_H
+#define SAVITZKY_GOLAY_H
+
+#include "Arduino.h"
+
+#define SAVITZKY_GOLAY_MAX_LEN 101 //!< Maximum number of samples, as specified by the length parameter in the constructor.
+
+/*!  This filter fits a quadratic (by least squares) to a set number of previous values and outputs the value of the fit at the middle
+of the window. Unlike MovingAverage, peaks and corners are preserved (a quadratic or cubic input is passed unchanged), but the output is
+delayed by (length-1)/2 samples. The slope of the fit gives a smoothed derivative, and the fit can also be evaluated at the newest sample
+to avoid the delay, at the cost of less smoothing.\n
+The fit only needs the sums of x, k*x and k^2*x over the window (k being the position in the window). When a new value arrives the oldest
+drops out and every other value moves down one place, which changes each sum by a combination of the lower sums, so the previous sums
+are corrected rather than recalculated. The sums are kept exactly in integers so no rounding error builds up.\n
+See http://en.wikipedia.org/wiki/Savitzky%E2%80%93Golay_filter \n
+ To use: create an instance of the filter and submit new readings using updateF().
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A finite length quadratic least-squares smoothing filter. */
+class SavitzkyGolay{
+public:
+  /*! Create the filter with specified parameters.
+   @param length The number of samples to take into account with a maximum specified by SAVITZKY_GOLAY_MAX_LEN. This should be odd; even values will be silently increased by 1.
+   At least 5 is needed for any smoothing, since 3 points fit a quadratic exactly.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  SavitzkyGolay(int length, boolean burnIn);
+
+  /*! Submit a new measurement to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param newVal The new value.
+   @returns The filter output, which is the smoothed value (length-1)/2 samples ago. */
+  float updateF(int newVal);
+
+  /*! @returns The slope (change per sample) of the fit at the middle of the window, as of the last updateF(). */
+  float getSlope();
+  /*! @returns The value of the fit at the newest sample, as of the last updateF(). This is not delayed but is less smooth than the output of updateF(). */
+  float getEndValue();
+  /*! @returns The slope (change per sample) of the fit at the newest sample, as of the last updateF(). */
+  float getEndSlope();
+
+  /*! Get the previously-submitted values. This is a "circular buffer" so the current pointer must be obtained using getLastIndex()
+  @param[out] values A buffer of length specified by the length parameter in the constructor. */
+  void getHistory(int values[]);
+  /*! What was the last index used in the returned buffer from getHistory()?
+  @returns The index to the value submitted by the last update() */
+  int getLastIndex();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+  int _length;
+
+  boolean _updated;//has the filter received any data yet
+  int _values[SAVITZKY_GOLAY_MAX_LEN];
+  int _index;// pointer into _values[]
+  //sums over the window of x, k*x and k^2*x, where k=0 for the oldest value and length-1 for the newest
+  long _sum0;
+  long long _sum1, _sum2;
+  //sums over the window of t^2 and t^4, where t=k-(length-1)/2, and the determinant of the least-squares equations
+  long long _p2, _p4, _det;
+  //the fit is a + b*t + c*t^2
+  float _a, _b, _c;
+
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "WeightedMovingAverage.h"
+
+WeightedMovingAverage::WeightedMovingAverage(int length, boolean burnIn){
+  //make sure the buffer length is within the allocated space
+  if(length>WEIGHTED_MOVING_AVERAGE_MAX_LEN){
+    _length = WEIGHTED_MOVING_AVERAGE_MAX_LEN;
+  }
+  else{
+    _length = length;
+  }
+  _divisor = long(_length)*(_length+1)/2;
+  _burnIn = burnIn;
+  _index = 0;
+  _updated=false;
+}
+
+int WeightedMovingAverage::update(int newVal){
+  accumulate(newVal);
+  //add half the divisor to compensate for integer division
+  return (_weightedSum+_divisor/2)/_divisor;
+}
+
+float WeightedMovingAverage::updateF(int newVal){
+  accumulate(newVal);
+  return float(_weightedSum)/float(_divisor);
+}
+
+// debugging
+void WeightedMovingAverage::getHistory(int values[]){
+  for(int i = 0; i<_length; i++){
+    values[i] = _values[i];
+  }
+}
+
+int WeightedMovingAverage::getLastIndex(){
+  int lastIndex = _index-1;
+  if(lastIndex<0){
+    lastIndex = _length-1;
+  }
+  return lastIndex;
+}
+
+//
+// private
+//
+void WeightedMovingAverage::accumulate(int newVal){
+  //This section is so that the history of samples is initialised on first use.
+  if(!_updated){
+    _updated= true;
+    int fillVal = 0;
+    if(_burnIn){
+      //fill _values with newVal rather than zeros such that the weighted average return value starts as newVal
+      fillVal = newVal;
+    }
+    for(int i=0; i<_length; i++){
+      _values[i]=fillVal;
+    }
+    _sum = long(fillVal)*_length;
+    _weightedSum = long(fillVal)*_divisor;
+  }
+
+  //This is where accumulation happens
+  //every weight drops by one (so the oldest value drops out) and newVal comes in with the largest weight
+  _weightedSum-=_sum;
+  _weightedSum+=long(newVal)*_length;
+  //update the total
+  _sum-=_values[_index];
+  _sum+=newVal;
+  //store the new value
+  _values[_index] = newVal;
+  //increment the pointer, bringing back to 0 as required
+  _index++;
+  _index = _index%_length;
+}
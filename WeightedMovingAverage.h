@@ -0,0 +1,78 @@
+/* WeightedMovingAverage.h - Linearly Weighted Moving Average Smoothing
+ Copyright 2026, LibSimpleFilters contributors */
+
+/* ***************************** LICENCE ************************************
+ *  This file is part of LibSimpleFilters Arduino library.                   *
+ *    (each component of the library is licenced separately)                 *
+ *                                                                           *
+ * WeightedMovingAverage is free software: you can redistribute it and/or modify     *
+ * it under the terms of the GNU Lesser General Public License as published  *
+ * by the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Lesser General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ ****************************************************************************/
+#ifndef WEIGHTED_MOVING_AVERAGE_H
+#define WEIGHTED_MOVING_AVERAGE_H
+
+#include "Arduino.h"
+
+#define WEIGHTED_MOVING_AVERAGE_MAX_LEN 100 //!< Maximum number of samples, as specified by the length parameter in the constructor. Absolute max is 360.
+
+/*!  This filter calculates a weighted average of a set number of previous values, where the newest value has weight=length,
+the one before has weight=length-1 and so on down to 1 for the oldest.
+This follows changes with less lag than MovingAverage of the same length, and values leave the window gradually rather than suddenly.\n
+The weighted sum is updated from the previous one rather than recalculated: when a new value arrives every weight drops by 1, which is
+the same as subtracting the plain sum of the window, and the new value is added with weight=length.\n
+See http://en.wikipedia.org/wiki/Moving_average#Weighted_moving_average \n
+ To use: create an instance of the filter and submit new readings using update().
+ Readings should be sampled at regular (i.e. equal) time intervals.
+ @brief  A finite length moving average with linear weighting. */
+class WeightedMovingAverage{
+public:
+  /*! Create the filter with specified parameters.
+   @param length The number of samples to take into account with a maximum specified by WEIGHTED_MOVING_AVERAGE_MAX_LEN.
+   @param burnIn Whether to initialise the filter on first reading such that the output = the input after that reading.
+   Otherwise the output is as if the input had just been turned on with previous zero readings. */
+  WeightedMovingAverage(int length, boolean burnIn);
+
+  /*! Submit a new measurement to the filter.\n
+  Readings should be sampled at regular (i.e. equal) time intervals.
+   @param newVal The new value.
+   @returns The filter output. */
+  int update(int newVal);
+
+  /*! Same as the integer version except that the average is computed using 4 byte floating point arithmetic. */
+  float updateF(int newVal);
+
+  /*! Get the previously-submitted values. This is a "circular buffer" so the current pointer must be obtained using getLastIndex()
+  @param[out] values A buffer of length specified by the length parameter in the constructor. */
+  void getHistory(int values[]);
+  /*! What was the last index used in the returned buffer from getHistory()?
+  @returns The index to the value submitted by the last update() */
+  int getLastIndex();
+
+private:
+  //constructor parameters
+  boolean _burnIn;
+  int _length;
+
+  boolean _updated;//has the filter received any data yet
+  int _values[WEIGHTED_MOVING_AVERAGE_MAX_LEN];
+  int _index;// pointer into _values[]
+  long _sum;//sum of values[]
+  long _weightedSum;//sum of values[] times their weights
+  long _divisor;//sum of the weights, length*(length+1)/2
+
+  //common code used by both update() methods
+  void accumulate(int newVal);
+
+};
+
+#endif